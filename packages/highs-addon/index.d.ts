@@ -21,6 +21,9 @@ export declare class Solver {
     upperBounds: Float64Array,
     weights: Matrix
   ): void;
+  getObjective(): Objective;
+  passLinearObjectives(objectives: ReadonlyArray<LinearObjective>): void;
+  clearLinearObjectives(): void;
 
   run(cb: (err: Error) => void): void;
   getModelStatus(): ModelStatus;
@@ -29,14 +32,22 @@ export declare class Solver {
 
   getSolution(): Solution;
   setSolution(
-    sol: Partial<Pick<Solution, 'columnValues' | 'rowDualValues'>>
+    sol: Partial<Pick<Solution, 'columnValues' | 'rowDualValues'>>,
+    cb: (err: Error) => void
+  ): void;
+  setSparseSolution(
+    indices: Int32Array,
+    values: Float64Array,
+    cb: (err: Error) => void
   ): void;
   writeSolution(
     fp: string,
     style: SolutionStyle,
     cb: (err: Error) => void
   ): void;
-  assessPrimalSolution(): SolutionAssessment;
+  assessPrimalSolution(
+    cb: (err: Error, assessment: SolutionAssessment) => void
+  ): void;
 
   clear(): void;
   clearModel(): void;
@@ -71,6 +82,7 @@ export interface TypedOptions {
   readonly log_to_console: boolean;
   readonly mip_abs_gap: number;
   readonly mip_rel_gap: number;
+  readonly blend_multi_objectives: boolean;
 }
 
 export interface Model {
@@ -121,6 +133,47 @@ export interface Model {
   readonly objectiveHessian?: Matrix;
 }
 
+/** The model's own (single) objective. */
+export interface Objective {
+  readonly isMaximization: boolean;
+  readonly offset: number;
+  readonly linearWeights: Float64Array;
+}
+
+// https://github.com/ERGO-Code/HiGHS/blob/master/src/lp_data/HStruct.h
+export interface LinearObjective {
+  /**
+   * Objective weights. Must have length equal to the model's number of
+   * variables.
+   */
+  readonly coefficients: Float64Array;
+
+  /**
+   * Objectives are optimized in decreasing order of priority when not blended
+   * (see the `blend_multi_objectives` option). Priorities must then be
+   * distinct.
+   */
+  readonly priority: number;
+
+  /**
+   * Objective weight, defaults to 1. Its sign also sets the optimization sense:
+   * objectives with positive weights are minimized, ones with negative weights
+   * maximized (the model's own sense is ignored). When blending, the weighted
+   * sum of all objectives is minimized.
+   */
+  readonly weight?: number;
+
+  /** Objective offset, defaults to 0. */
+  readonly offset?: number;
+
+  /**
+   * Tolerances used to bound this objective when optimizing lower priority
+   * ones. Both default to 0.
+   */
+  readonly absoluteTolerance?: number;
+  readonly relativeTolerance?: number;
+}
+
 export interface Matrix {
   readonly offsets: Int32Array;
   readonly indices: Int32Array;
@@ -15,6 +15,9 @@ void Solver::Init(Napi::Env env, Napi::Object exports) {
                    InstanceMethod("changeObjectiveOffset", &Solver::ChangeObjectiveOffset),
                    InstanceMethod("changeColsCost", &Solver::ChangeColsCost),
                    InstanceMethod("addRows", &Solver::AddRows),
+                   InstanceMethod("getObjective", &Solver::GetObjective),
+                   InstanceMethod("passLinearObjectives", &Solver::PassLinearObjectives),
+                   InstanceMethod("clearLinearObjectives", &Solver::ClearLinearObjectives),
 
                    InstanceMethod("run", &Solver::Run),
                    InstanceMethod("getModelStatus", &Solver::GetModelStatus),
@@ -23,6 +26,7 @@ void Solver::Init(Napi::Env env, Napi::Object exports) {
                    
                    InstanceMethod("getSolution", &Solver::GetSolution),
                    InstanceMethod("setSolution", &Solver::SetSolution),
+                   InstanceMethod("setSparseSolution", &Solver::SetSparseSolution),
                    InstanceMethod("writeSolution", &Solver::WriteSolution),
                    InstanceMethod("assessPrimalSolution", &Solver::AssessPrimalSolution),
 
@@ -372,6 +376,72 @@ void Solver::AddRows(const Napi::CallbackInfo& info) {
   }
 }
 
+Napi::Value Solver::GetObjective(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  int length = info.Length();
+  if (length != 0) {
+    ThrowTypeError(env, "Expected 0 arguments");
+    return env.Undefined();
+  }
+  Napi::Object obj = Napi::Object::New(env);
+  const HighsLp& lp = this->highs_->getLp();
+  obj.Set("isMaximization", lp.sense_ == ObjSense::kMaximize);
+  obj.Set("offset", lp.offset_);
+  obj.Set("linearWeights", ToFloat64Array(env, lp.col_cost_));
+  return obj;
+}
+
+double ToDouble(const Napi::Value& val, double fallback) {
+  return val.IsUndefined() ? fallback : val.As<Napi::Number>().DoubleValue();
+}
+
+void Solver::PassLinearObjectives(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  int length = info.Length();
+  if (length != 1 || !info[0].IsArray()) {
+    ThrowTypeError(env, "Expected 1 argument [array]");
+    return;
+  }
+
+  Napi::Array arr = info[0].As<Napi::Array>();
+  std::vector<HighsLinearObjective> objs(arr.Length());
+  for (uint32_t i = 0; i < arr.Length(); i++) {
+    Napi::Value val = arr.Get(i);
+    if (!val.IsObject()) {
+      ThrowTypeError(env, "Invalid linear objective");
+      return;
+    }
+    Napi::Object obj = val.As<Napi::Object>();
+    HighsLinearObjective& lobj = objs[i];
+    AssignToVector(lobj.coefficients, obj.Get("coefficients"));
+    lobj.weight = ToDouble(obj.Get("weight"), 1);
+    lobj.offset = ToDouble(obj.Get("offset"), 0);
+    lobj.abs_tolerance = ToDouble(obj.Get("absoluteTolerance"), 0);
+    lobj.rel_tolerance = ToDouble(obj.Get("relativeTolerance"), 0);
+    lobj.priority = obj.Get("priority").As<Napi::Number>().Int32Value();
+  }
+
+  HighsStatus status = this->highs_->passLinearObjectives((HighsInt) objs.size(), objs.data());
+  if (status != HighsStatus::kOk) {
+    ThrowError(env, "Pass linear objectives failed");
+    return;
+  }
+}
+
+void Solver::ClearLinearObjectives(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  int length = info.Length();
+  if (length != 0) {
+    ThrowTypeError(env, "Expected 0 arguments");
+    return;
+  }
+  HighsStatus status = this->highs_->clearLinearObjectives();
+  if (status != HighsStatus::kOk) {
+    ThrowError(env, "Clear linear objectives failed");
+    return;
+  }
+}
+
 // Running
 
 class RunWorker : public UpdateWorker {
@@ -443,12 +513,6 @@ Napi::Value Solver::GetRunTime(const Napi::CallbackInfo &info) {
 
 // Solutions
 
-Napi::Value ToFloat64Array(const Napi::Env& env, const std::vector<double>& vec) {
-  Napi::Float64Array arr = Napi::Float64Array::New(env, vec.size());
-  std::copy(vec.begin(), vec.end(), arr.Data());
-  return arr;
-}
-
 Napi::Value Solver::GetSolution(const Napi::CallbackInfo& info) {
   Napi::Env env = info.Env();
   int length = info.Length();
@@ -467,44 +531,159 @@ Napi::Value Solver::GetSolution(const Napi::CallbackInfo& info) {
   return obj;
 }
 
+class SetSolutionWorker : public UpdateWorker {
+ public:
+  SetSolutionWorker(Napi::Function& cb, std::shared_ptr<Highs> highs, const Napi::Object& obj)
+  : UpdateWorker(cb, highs, "Set solution"),
+    colValues_(obj.Get("columnValues")),
+    colDualValues_(obj.Get("columnDualValues")),
+    rowValues_(obj.Get("rowValues")),
+    rowDualValues_(obj.Get("rowDualValues")) {}
+
+  HighsStatus Update(Highs& highs) override {
+    // Copying is done here rather than on the main thread since solutions can
+    // be large; the arrays are kept alive by their references until then.
+    HighsSolution sol;
+    this->colValues_.AssignTo(sol.col_value);
+    this->colDualValues_.AssignTo(sol.col_dual);
+    this->rowValues_.AssignTo(sol.row_value);
+    this->rowDualValues_.AssignTo(sol.row_dual);
+    return highs.setSolution(sol);
+  }
+
+ private:
+  PinnedFloat64Array colValues_;
+  PinnedFloat64Array colDualValues_;
+  PinnedFloat64Array rowValues_;
+  PinnedFloat64Array rowDualValues_;
+};
+
 void Solver::SetSolution(const Napi::CallbackInfo& info) {
   Napi::Env env = info.Env();
   int length = info.Length();
-  if (length != 1 || !info[0].IsObject()) {
-    ThrowTypeError(env, "Expected 1 argument [object]");
+  if (length != 2 || !info[0].IsObject() || !info[1].IsFunction()) {
+    ThrowTypeError(env, "Expected 2 arguments [object, function]");
     return;
   }
   Napi::Object obj = info[0].As<Napi::Object>();
+  Napi::Function cb = info[1].As<Napi::Function>();
+  SetSolutionWorker* worker = new SetSolutionWorker(cb, this->highs_, obj);
+  worker->Queue();
+}
 
-  HighsSolution sol;
-  AssignToVector(sol.col_value, obj.Get("columnValues"));
-  AssignToVector(sol.col_dual, obj.Get("columnDualValues"));
-  AssignToVector(sol.row_value, obj.Get("rowValues"));
-  AssignToVector(sol.row_dual, obj.Get("rowDualValues"));
+class SetSparseSolutionWorker : public UpdateWorker {
+ public:
+  SetSparseSolutionWorker(
+    Napi::Function& cb,
+    std::shared_ptr<Highs> highs,
+    std::vector<HighsInt> indices,
+    std::vector<double> values,
+    bool hasDuplicates
+  )
+  : UpdateWorker(cb, highs, "Set sparse solution"),
+    indices_(std::move(indices)),
+    values_(std::move(values)),
+    hasDuplicates_(hasDuplicates) {}
 
-  HighsStatus status = this->highs_->setSolution(sol);
-  if (status != HighsStatus::kOk) {
-    ThrowError(env, "Set solution failed");
+  HighsStatus Update(Highs& highs) override {
+    HighsStatus status = highs.setSolution(
+      (HighsInt) this->indices_.size(),
+      this->indices_.data(),
+      this->values_.data()
+    );
+    // Duplicate indices produce a warning (the last value is used), which we
+    // accept. Other warnings are surfaced as failures.
+    if (status == HighsStatus::kWarning && this->hasDuplicates_) {
+      return HighsStatus::kOk;
+    }
+    return status;
+  }
+
+ private:
+  std::vector<HighsInt> indices_;
+  std::vector<double> values_;
+  bool hasDuplicates_;
+};
+
+void Solver::SetSparseSolution(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  int length = info.Length();
+  if (
+    length != 3 ||
+    !info[0].IsTypedArray() ||
+    !info[1].IsTypedArray() ||
+    !info[2].IsFunction()
+  ) {
+    ThrowTypeError(env, "Expected 3 arguments [Int32Array, Float64Array, function]");
+    return;
+  }
+
+  Napi::Int32Array indices = info[0].As<Napi::Int32Array>();
+  Napi::Float64Array values = info[1].As<Napi::Float64Array>();
+  if (indices.ElementLength() != values.ElementLength()) {
+    ThrowError(env, "Inconsistent sparse solution length");
     return;
   }
+  std::vector<HighsInt> indicesVec(indices.Data(), indices.Data() + indices.ElementLength());
+  HighsInt numCol = this->highs_->getNumCol();
+  std::vector<bool> seen(numCol, false);
+  bool hasDuplicates = false;
+  for (HighsInt ix : indicesVec) {
+    if (ix < 0 || ix >= numCol) {
+      ThrowError(env, "Sparse solution index out of range");
+      return;
+    }
+    hasDuplicates = hasDuplicates || seen[ix];
+    seen[ix] = true;
+  }
+  std::vector<double> valuesVec;
+  AssignToVector(valuesVec, values);
+
+  Napi::Function cb = info[2].As<Napi::Function>();
+  SetSparseSolutionWorker* worker = new SetSparseSolutionWorker(
+    cb, this->highs_, std::move(indicesVec), std::move(valuesVec), hasDuplicates);
+  worker->Queue();
 }
 
-Napi::Value Solver::AssessPrimalSolution(const Napi::CallbackInfo& info) {
+class AssessPrimalSolutionWorker : public Napi::AsyncWorker {
+ public:
+  AssessPrimalSolutionWorker(Napi::Function& cb, std::shared_ptr<Highs> highs)
+  : Napi::AsyncWorker(cb), highs_(highs) {}
+
+  void Execute() override {
+    HighsStatus status = this->highs_->assessPrimalSolution(
+      this->valid_, this->integral_, this->feasible_);
+    this->ok_ = status == HighsStatus::kOk;
+  }
+
+  void OnOK() override {
+    Napi::Env env = Env();
+    Napi::HandleScope scope(env);
+    Napi::Object obj = Napi::Object::New(env);
+    obj.Set("isValid", this->ok_ && this->valid_);
+    obj.Set("isIntegral", this->ok_ && this->integral_);
+    obj.Set("isFeasible", this->ok_ && this->feasible_);
+    Callback().Call({env.Null(), obj});
+  }
+
+ private:
+  std::shared_ptr<Highs> highs_;
+  bool ok_ = false;
+  bool valid_ = false;
+  bool integral_ = false;
+  bool feasible_ = false;
+};
+
+void Solver::AssessPrimalSolution(const Napi::CallbackInfo& info) {
   Napi::Env env = info.Env();
   int length = info.Length();
-  if (length != 0) {
-    ThrowTypeError(env, "Expected 0 arguments");
-    return env.Undefined();
+  if (length != 1 || !info[0].IsFunction()) {
+    ThrowTypeError(env, "Expected 1 argument [function]");
+    return;
   }
-
-  bool valid, integral, feasible;
-  Napi::Object obj = Napi::Object::New(env);
-  HighsStatus status = this->highs_->assessPrimalSolution(valid, integral, feasible);
-  bool ok = status == HighsStatus::kOk;
-  obj.Set("isValid", ok && valid);
-  obj.Set("isIntegral", ok && integral);
-  obj.Set("isFeasible", ok && feasible);
-  return obj;
+  Napi::Function cb = info[0].As<Napi::Function>();
+  AssessPrimalSolutionWorker* worker = new AssessPrimalSolutionWorker(cb, this->highs_);
+  worker->Queue();
 }
 
 class WriteSolutionWorker : public UpdateWorker {
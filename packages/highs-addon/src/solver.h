@@ -20,6 +20,9 @@ class Solver : public Napi::ObjectWrap<Solver> {
   void ChangeObjectiveOffset(const Napi::CallbackInfo& info);
   void ChangeColsCost(const Napi::CallbackInfo& info);
   void AddRows(const Napi::CallbackInfo& info);
+  Napi::Value GetObjective(const Napi::CallbackInfo& info);
+  void PassLinearObjectives(const Napi::CallbackInfo& info);
+  void ClearLinearObjectives(const Napi::CallbackInfo& info);
 
   void Run(const Napi::CallbackInfo& info);
   Napi::Value GetModelStatus(const Napi::CallbackInfo& info);
@@ -28,8 +31,9 @@ class Solver : public Napi::ObjectWrap<Solver> {
 
   Napi::Value GetSolution(const Napi::CallbackInfo& info);
   void SetSolution(const Napi::CallbackInfo& info);
+  void SetSparseSolution(const Napi::CallbackInfo& info);
   void WriteSolution(const Napi::CallbackInfo& info);
-  Napi::Value AssessPrimalSolution(const Napi::CallbackInfo& info);
+  void AssessPrimalSolution(const Napi::CallbackInfo& info);
 
   void Clear(const Napi::CallbackInfo& info);
   void ClearModel(const Napi::CallbackInfo& info);
@@ -27,3 +27,26 @@ void AssignToVector(std::vector<double>& vec, Napi::Value val) {
   double *data = arr.Data();
   vec.assign(data, data + len);
 }
+
+Napi::Value ToFloat64Array(const Napi::Env& env, const std::vector<double>& vec) {
+  Napi::Float64Array arr = Napi::Float64Array::New(env, vec.size());
+  std::copy(vec.begin(), vec.end(), arr.Data());
+  return arr;
+}
+
+PinnedFloat64Array::PinnedFloat64Array(Napi::Value val) {
+  if (val.IsUndefined()) {
+    return;
+  }
+  Napi::Float64Array arr = val.As<Napi::Float64Array>();
+  this->ref_ = Napi::Persistent(arr);
+  this->data_ = arr.Data();
+  this->length_ = arr.ElementLength();
+}
+
+void PinnedFloat64Array::AssignTo(std::vector<double>& vec) const {
+  if (this->data_ == nullptr) {
+    return;
+  }
+  vec.assign(this->data_, this->data_ + this->length_);
+}
@@ -12,4 +12,23 @@ void ThrowTypeError(const Napi::Env& env, const std::string msg);
 
 void AssignToVector(std::vector<double>& vec, Napi::Value val);
 
+Napi::Value ToFloat64Array(const Napi::Env& env, const std::vector<double>& vec);
+
+/**
+ * Float64Array kept alive via a reference, so that its data can be read from a
+ * worker thread. The array must not be mutated while the worker runs.
+ */
+class PinnedFloat64Array {
+ public:
+  PinnedFloat64Array(Napi::Value val);
+
+  /** Copies the array's data into the vector. This is a no-op if undefined. */
+  void AssignTo(std::vector<double>& vec) const;
+
+ private:
+  Napi::Reference<Napi::Float64Array> ref_;
+  double* data_ = nullptr;
+  size_t length_ = 0;
+};
+
 #endif
@@ -123,6 +123,52 @@ describe('solver', () => {
     });
   });
 
+  test('solves lexicographic objectives', async () => {
+    await withSolver(async (solver) => {
+      solver.passModel({
+        columnCount: 2,
+        rowCount: 1,
+        isMaximization: true,
+        columnLowerBounds: new Float64Array([0, 0]),
+        columnUpperBounds: new Float64Array([10, 10]),
+        rowLowerBounds: new Float64Array([-Infinity]),
+        rowUpperBounds: new Float64Array([10]),
+        objectiveLinearWeights: new Float64Array(2),
+        weights: {
+          offsets: new Int32Array([0]),
+          indices: new Int32Array([0, 1]),
+          values: new Float64Array([1, 1]),
+        },
+      });
+      solver.setOption('blend_multi_objectives', false);
+      solver.passLinearObjectives([
+        {coefficients: new Float64Array([0, 1]), weight: -1, priority: 1},
+        {coefficients: new Float64Array([1, 1]), weight: -1, priority: 2},
+      ]);
+
+      await p(solver, 'run');
+      expect(solver.getModelStatus()).toEqual(7); // Optimal
+      expect(solver.getSolution()).toMatchObject({
+        isValueValid: true,
+        columnValues: new Float64Array([0, 10]),
+      });
+    });
+  });
+
+  test('throws passing inconsistent linear objectives', async () => {
+    await withSolver(async (solver) => {
+      await p(solver, 'readModel', resourcePath('simple.lp'));
+      try {
+        solver.passLinearObjectives([
+          {coefficients: new Float64Array([1]), priority: 1},
+        ]);
+        fail();
+      } catch (err) {
+        expect(err.message).toMatch(/Pass linear objectives failed/);
+      }
+    });
+  });
+
   test('solves reading LP file', async () => {
     await withSolver(async (solver) => {
       await p(solver, 'readModel', resourcePath('simple.lp'));
@@ -171,7 +217,7 @@ describe('solver', () => {
         isValueValid: true,
         isDualValid: true,
       });
-      expect(solver.assessPrimalSolution()).toEqual({
+      expect(await p(solver, 'assessPrimalSolution')).toEqual({
         isValid: true,
         isIntegral: true,
         isFeasible: true,
@@ -182,7 +228,7 @@ describe('solver', () => {
         isValueValid: false,
         isDualValid: false,
       });
-      expect(solver.assessPrimalSolution()).toEqual({
+      expect(await p(solver, 'assessPrimalSolution')).toEqual({
         isValid: false,
         isIntegral: false,
         isFeasible: false,
@@ -193,17 +239,51 @@ describe('solver', () => {
   test('sets solution', async () => {
     await withSolver(async (solver) => {
       await p(solver, 'readModel', resourcePath('simple.lp'));
-      expect(solver.assessPrimalSolution()).toEqual({
+      expect(await p(solver, 'assessPrimalSolution')).toEqual({
         isValid: false,
         isIntegral: false,
         isFeasible: false,
       });
 
-      solver.setSolution({
+      await p(solver, 'setSolution', {
         columnValues: new Float64Array([17.5, 1, 15.5, 2]),
         rowDualValues: new Float64Array([1.5, 2.5, 11.5]),
       });
-      expect(solver.assessPrimalSolution()).toEqual({
+      expect(await p(solver, 'assessPrimalSolution')).toEqual({
+        isValid: true,
+        isIntegral: true,
+        isFeasible: true,
+      });
+    });
+  });
+
+  test('sets sparse solution', async () => {
+    await withSolver(async (solver) => {
+      await p(solver, 'readModel', resourcePath('simple.lp'));
+      await p(
+        solver,
+        'setSparseSolution',
+        new Int32Array([2, 0, 3, 1]),
+        new Float64Array([15.5, 17.5, 2, 1])
+      );
+      expect(await p(solver, 'assessPrimalSolution')).toEqual({
+        isValid: true,
+        isIntegral: true,
+        isFeasible: true,
+      });
+    });
+  });
+
+  test('sets sparse solution with duplicate indices', async () => {
+    await withSolver(async (solver) => {
+      await p(solver, 'readModel', resourcePath('simple.lp'));
+      await p(
+        solver,
+        'setSparseSolution',
+        new Int32Array([0, 1, 2, 3, 0]),
+        new Float64Array([0, 1, 15.5, 2, 17.5])
+      );
+      expect(await p(solver, 'assessPrimalSolution')).toEqual({
         isValid: true,
         isIntegral: true,
         isFeasible: true,
@@ -211,6 +291,58 @@ describe('solver', () => {
     });
   });
 
+  test('throws setting out of range sparse solution', async () => {
+    await withSolver(async (solver) => {
+      await p(solver, 'readModel', resourcePath('simple.lp'));
+      try {
+        await p(
+          solver,
+          'setSparseSolution',
+          new Int32Array([4]),
+          new Float64Array([1])
+        );
+        fail();
+      } catch (err) {
+        expect(err.message).toMatch(/Sparse solution index out of range/);
+      }
+    });
+  });
+
+  test('solves MIP from partial sparse solution', async () => {
+    await withSolver(async (solver) => {
+      solver.passModel({
+        columnCount: 3,
+        rowCount: 2,
+        isMaximization: true,
+        columnTypes: new Int32Array([1, 1, 1]),
+        columnLowerBounds: new Float64Array([0, 0, 0]),
+        columnUpperBounds: new Float64Array([1, 1, 1]),
+        rowLowerBounds: new Float64Array([-Infinity, -Infinity]),
+        rowUpperBounds: new Float64Array([1, 1]),
+        objectiveLinearWeights: new Float64Array([1, 1, 1]),
+        weights: {
+          offsets: new Int32Array([0, 2]),
+          indices: new Int32Array([0, 1, 1, 2]),
+          values: new Float64Array([1, 1, 1, 1]),
+        },
+      });
+      await p(
+        solver,
+        'setSparseSolution',
+        new Int32Array([0]),
+        new Float64Array([1])
+      );
+      expect(solver.getSolution().columnValues[0]).toEqual(1);
+
+      await p(solver, 'run');
+      expect(solver.getModelStatus()).toEqual(7); // Optimal
+      expect(cloneSolution(solver.getSolution())).toMatchObject({
+        isValueValid: true,
+        columnValues: new Float64Array([1, 0, 1]),
+      });
+    });
+  });
+
   test('writes model', async () => {
     await withSolver(async (solver) => {
       await p(solver, 'readModel', resourcePath('simple.lp'));
@@ -263,12 +395,18 @@ function p<M extends keyof sut.Solver>(
   solver: sut.Solver,
   method: M,
   ...args: sut.Solver[M] extends (
-    ...args: [...infer A, (err: Error) => void]
+    ...args: [...infer A, (err: Error, res?: any) => void]
   ) => void
     ? A
     : never
-): Promise<void> {
-  return util.promisify(solver[method]).bind(solver)(...args);
+): Promise<
+  sut.Solver[M] extends (
+    ...args: [...any, (err: Error, res: infer R) => void]
+  ) => void
+    ? R
+    : never
+> {
+  return util.promisify(solver[method] as Function).bind(solver)(...args);
 }
 
 function resourcePath(fn: string): string {
@@ -22,9 +22,11 @@ export {
   solverErrorTag,
   SolverInfo,
   SolverModel,
+  SolverObjective,
   SolverOptions,
   SolverSolution,
   SolverSolutionValues,
+  SolverSparseValues,
   SolverStatus,
 } from './solver.js';
 // We don't export values here since highs-addon is a CommonJS package and
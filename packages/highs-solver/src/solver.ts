@@ -34,6 +34,8 @@ const [errors, errorCodes] = errorFactories({
       cause,
     }),
     solveInProgress: 'No mutations may be performed while a solve is running',
+    warmStartInProgress:
+      'No mutations may be performed while a warm start is running',
     solveNonOptimal: (
       solver: Solver,
       status: SolverStatus,
@@ -52,6 +54,8 @@ export {errorCodes};
 /** Higher level wrapping class around the HiGHS addon. */
 export class Solver {
   private solving = false;
+  private warmStarting = false;
+  private objectives: ObjectivesOverride | undefined;
   private constructor(
     private readonly delegate: addon.Solver,
     private readonly telemetry: Telemetry
@@ -92,6 +96,7 @@ export class Solver {
   setModel(model: SolverModel): void {
     this.assertNotSolving();
     this.telemetry.logger.debug('Setting inline model.');
+    this.clearObjectives();
 
     const width = model.columnLowerBounds.length;
     const height = model.rowLowerBounds.length;
@@ -151,6 +156,7 @@ export class Solver {
     this.assertNotSolving();
     const {telemetry: tel} = this;
     tel.logger.debug('Setting model from %j...', pl);
+    this.clearObjectives();
     await tel.withActiveSpan({name: 'HiGHS read model file'}, () =>
       this.delegatedPromise('readModel', localPath(pl))
     );
@@ -170,7 +176,9 @@ export class Solver {
 
   /**
    * Updates the model's objective, keeping everything else as-is. Any fields
-   * undefined in the input will be left unchanged.
+   * undefined in the input will be left unchanged. This method may not be
+   * called while objectives set via `setObjectives` are active since they take
+   * precedence over the model's objective.
    */
   updateObjective(args: {
     readonly isMaximization?: boolean;
@@ -184,6 +192,7 @@ export class Solver {
   }): void {
     this.assertNotSolving();
     this.telemetry.logger.debug('Updating objective.');
+    assert(!this.objectives, 'Objectives overridden by setObjectives');
 
     ifPresent(
       args.isMaximization,
@@ -199,6 +208,90 @@ export class Solver {
     );
   }
 
+  /**
+   * Sets multiple objectives, replacing the model's own objective until they
+   * are cleared or a new model is set. The model's objective and the
+   * `blend_multi_objectives` option are restored when cleared. By default objectives are optimized
+   * lexicographically, in decreasing order of priority, within a single solve.
+   * The solution's `objectiveValues` field then holds each objective's value at
+   * the final solution. Note that these may differ from the optimum found for
+   * an objective at its own priority level when tolerances are non-zero.
+   */
+  setObjectives(
+    objectives: ReadonlyArray<SolverObjective>,
+    opts?: {
+      /** Minimize a weighted sum of the objectives instead. */
+      readonly blend?: boolean;
+    }
+  ): void {
+    this.assertNotSolving();
+    this.telemetry.logger.debug('Setting %s objectives.', objectives.length);
+
+    assert(objectives.length > 0, 'Empty objectives');
+    const width = objectives[0]?.linearWeights.length;
+    assert(
+      objectives.every((o) => o.linearWeights.length === width),
+      'Inconsistent width'
+    );
+    assert(
+      objectives.every((o) => o.weight == null || o.weight > 0),
+      'Non-positive weight'
+    );
+    if (!opts?.blend) {
+      const priorities = new Set(objectives.map((o) => o.priority));
+      assert(priorities.size === objectives.length, 'Duplicate priority');
+    }
+
+    // HiGHS overwrites the model's objective when solving with multiple
+    // objectives, so we keep the original (from before any earlier call).
+    const prev = this.objectives;
+    const original = prev?.original ?? this.delegated('getObjective');
+    const blendOption =
+      prev?.blendOption ?? this.delegated('getOption', 'blend_multi_objectives');
+
+    // HiGHS may keep a partial set of objectives if passing them fails, we
+    // clear them to avoid reporting values for stale ones.
+    this.objectives = undefined;
+    try {
+      this.delegated(
+        'passLinearObjectives',
+        objectives.map(({linearWeights, isMaximization, weight, ...rest}) => ({
+          ...rest,
+          coefficients: linearWeights,
+          // HiGHS maximizes objectives with negative weights.
+          weight: (isMaximization ? -1 : 1) * (weight ?? 1),
+        }))
+      );
+    } catch (err) {
+      this.restoreObjective(original, blendOption);
+      throw err;
+    }
+    this.delegated('setOption', 'blend_multi_objectives', !!opts?.blend);
+    this.objectives = {
+      // Copied so that later values are computed from the optimized weights.
+      values: objectives.map((o) => ({
+        ...o,
+        linearWeights: o.linearWeights.slice(),
+      })),
+      original,
+      blendOption,
+    };
+  }
+
+  /**
+   * Clears any objectives set via `setObjectives`, restoring the model's
+   * objective. This method is a no-op if no such objectives are set.
+   */
+  clearObjectives(): void {
+    this.assertNotSolving();
+    const {objectives} = this;
+    if (!objectives) {
+      return;
+    }
+    this.restoreObjective(objectives.original, objectives.blendOption);
+    this.objectives = undefined;
+  }
+
   /** Adds constraint rows to the loaded model. */
   addRows(args: {
     readonly weights: addon.Matrix;
@@ -223,32 +316,67 @@ export class Solver {
   }
 
   /**
-   * Warm-starts the solver with a solution. By default this method will also
-   * check that the solution is valid and throw an illegal warm-start error if
-   * not.
+   * Warm-starts the solver with a solution. Primal values may be specified
+   * either densely (one value per variable) or sparsely, in which case the
+   * solver will attempt to complete the partial assignment (e.g. via a sub-MIP)
+   * when solving. By default this method will also check that dense solutions
+   * are valid and throw an illegal warm-start error if not. Both setting and
+   * checking the solution run off the main thread; no mutating operations may
+   * be performed on the solver until the returned promise is resolved.
    */
-  warmStart(args: {
+  async warmStart(args: {
     /** New primal solution values. */
-    readonly primalColumns: Float64Array;
+    readonly primalColumns: Float64Array | SolverSparseValues;
 
-    /** Optional dual values. */
+    /** Optional dual values, only allowed with dense primal values. */
     readonly dualRows?: Float64Array;
 
-    /** Do not check that the solution is valid. */
+    /**
+     * Do not check that the solution is valid. Sparse solutions are never
+     * checked since they are completed during the solve.
+     */
     readonly allowInvalid?: boolean;
-  }): void {
+  }): Promise<void> {
     this.assertNotSolving();
-    this.telemetry.logger.debug('Adding warm-start solution.');
+    const {telemetry: tel} = this;
+    tel.logger.debug('Adding warm-start solution.');
+
+    const {primalColumns: cols} = args;
+    if (!(cols instanceof Float64Array)) {
+      assert(
+        cols.indices.length === cols.values.length,
+        'Inconsistent sparse values'
+      );
+      assert(!args.dualRows, 'Dual values require dense primal values');
+    }
 
-    this.delegated('setSolution', {
-      columnValues: args.primalColumns,
-      rowDualValues: args.dualRows,
-    });
-    if (!args.allowInvalid) {
-      const {isValid} = this.delegated('assessPrimalSolution');
-      if (!isValid) {
-        throw errors.invalidWarmStart();
-      }
+    this.warmStarting = true;
+    try {
+      await tel.withActiveSpan({name: 'HiGHS warm start'}, async () => {
+        if (!(cols instanceof Float64Array)) {
+          await this.delegatedPromise(
+            'setSparseSolution',
+            cols.indices,
+            cols.values
+          );
+          return;
+        }
+
+        await this.delegatedPromise('setSolution', {
+          columnValues: cols,
+          rowDualValues: args.dualRows,
+        });
+        if (!args.allowInvalid) {
+          const {isValid} = await this.delegatedPromise(
+            'assessPrimalSolution'
+          );
+          if (!isValid) {
+            throw errors.invalidWarmStart();
+          }
+        }
+      });
+    } finally {
+      this.warmStarting = false;
     }
   }
 
@@ -367,8 +495,18 @@ export class Solver {
       return undefined;
     }
     const info = this.delegated('getInfo');
+    const cols = sol.columnValues;
     return {
       objectiveValue: info.objective_function_value,
+      objectiveValues: this.objectives
+        ? Float64Array.from(this.objectives.values, (o) => {
+            let val = o.offset ?? 0;
+            for (const [ix, w] of o.linearWeights.entries()) {
+              val += w * cols[ix]!;
+            }
+            return val;
+          })
+        : undefined,
       relativeGap: info.mip_node_count >= 0 ? info.mip_gap : undefined,
       primal: {rows: sol.rowValues, columns: sol.columnValues},
       dual: sol.isDualValid
@@ -397,7 +535,7 @@ export class Solver {
   private delegated<M extends keyof addon.Solver>(
     method: M,
     ...args: addon.Solver[M] extends (...args: infer A) => any
-      ? A extends [...any, (err: Error) => void]
+      ? A extends [...any, (err: Error, res?: any) => void]
         ? never
         : A
       : never
@@ -413,23 +551,47 @@ export class Solver {
   private async delegatedPromise<M extends keyof addon.Solver>(
     method: M,
     ...args: addon.Solver[M] extends (
-      ...args: [...infer A, (err: Error) => void]
+      ...args: [...infer A, (err: Error, res?: any) => void]
     ) => void
       ? A
       : never
-  ): Promise<void> {
+  ): Promise<
+    addon.Solver[M] extends (
+      ...args: [...any, (err: Error, res: infer R) => void]
+    ) => void
+      ? R
+      : never
+  > {
     const {delegate} = this;
     try {
-      return await util.promisify(delegate[method]).bind(delegate)(...args);
+      return await util
+        .promisify(delegate[method] as Function)
+        .bind(delegate)(...args);
     } catch (cause) {
       throw errors.nativeMethodFailed(method, cause);
     }
   }
 
+  private restoreObjective(
+    obj: addon.Objective,
+    blendOption: addon.OptionValue
+  ): void {
+    this.delegated('clearLinearObjectives');
+    this.delegated('setOption', 'blend_multi_objectives', blendOption);
+    this.delegated('changeObjectiveSense', obj.isMaximization);
+    this.delegated('changeObjectiveOffset', obj.offset);
+    if (obj.linearWeights.length) {
+      this.delegated('changeColsCost', obj.linearWeights);
+    }
+  }
+
   private assertNotSolving(): void {
     if (this.solving) {
       throw errors.solveInProgress();
     }
+    if (this.warmStarting) {
+      throw errors.warmStartInProgress();
+    }
   }
 
   [util.inspect.custom](): string {
@@ -467,16 +629,65 @@ export type SolverModel = Omit<
 
 export interface SolverSolution {
   readonly objectiveValue: number;
+
+  /**
+   * Value of each objective set via `setObjectives` at this solution, in the
+   * same order. Absent if no such objectives were set.
+   */
+  readonly objectiveValues?: Float64Array;
+
   readonly relativeGap?: number;
   readonly primal: SolverSolutionValues;
   readonly dual?: SolverSolutionValues;
 }
 
+export interface SolverObjective {
+  /**
+   * Objective linear costs. Must have length equal to the model's number of
+   * variables.
+   */
+  readonly linearWeights: Float64Array;
+
+  /** Objectives with higher priority are optimized first. */
+  readonly priority: number;
+
+  /** Objective sense, defaults to minimization. */
+  readonly isMaximization?: boolean;
+
+  /**
+   * Positive weight used when blending objectives, defaults to 1. The blended
+   * objective is the weighted sum of minimized objectives minus the weighted
+   * sum of maximized ones.
+   */
+  readonly weight?: number;
+
+  /** Objective offset, defaults to 0. */
+  readonly offset?: number;
+
+  /**
+   * Slack allowed on this objective's optimal value when optimizing lower
+   * priority objectives. Both tolerances default to 0.
+   */
+  readonly absoluteTolerance?: number;
+  readonly relativeTolerance?: number;
+}
+
+interface ObjectivesOverride {
+  readonly values: ReadonlyArray<SolverObjective>;
+  readonly original: addon.Objective;
+  readonly blendOption: addon.OptionValue;
+}
+
 export interface SolverSolutionValues {
   readonly rows: Float64Array;
   readonly columns: Float64Array;
 }
 
+export interface SolverSparseValues {
+  readonly indices: Int32Array;
+  readonly values: Float64Array;
+}
+
 export interface SolverOptions extends Partial<addon.TypedOptions> {
   readonly [name: string]: addon.OptionValue | undefined;
 }
@@ -3,6 +3,7 @@ import {ResourceLoader} from '@mtth/stl-utils/files';
 import {readFile} from 'fs/promises';
 import * as tmp from 'tmp-promise';
 
+import {ColumnType} from '../src/common.js';
 import errorCodes from '../src/index.errors.js';
 import * as sut from '../src/solver.js';
 
@@ -143,7 +144,7 @@ describe('solver', () => {
       await solver.setModelFromFile(loader.localUrl('simple.lp'));
       const primal = new Float64Array([17.5, 1, 15.5, 2]);
       const dual = new Float64Array([1.5, 2.5, 11.5]);
-      solver.warmStart({primalColumns: primal, dualRows: dual});
+      await solver.warmStart({primalColumns: primal, dualRows: dual});
       expect(solver.getSolution()).toMatchObject({
         primal: {columns: primal},
         dual: {rows: dual},
@@ -154,7 +155,7 @@ describe('solver', () => {
       const solver = sut.Solver.create();
       await solver.setModelFromFile(loader.localUrl('simple.lp'));
       try {
-        solver.warmStart({
+        await solver.warmStart({
           primalColumns: new Float64Array([20, 1, 15.5, 2]),
         });
         fail();
@@ -162,6 +163,101 @@ describe('solver', () => {
         expect(err).toMatchObject({code: errorCodes.InvalidWarmStart});
       }
     });
+
+    test('accepts sparse solution', async () => {
+      const solver = sut.Solver.create();
+      await solver.setModelFromFile(loader.localUrl('simple.lp'));
+      await solver.warmStart({
+        primalColumns: {
+          indices: new Int32Array([2, 0, 3, 1]),
+          values: new Float64Array([15.5, 17.5, 2, 1]),
+        },
+      });
+      expect(solver.getSolution()).toMatchObject({
+        primal: {columns: new Float64Array([17.5, 1, 15.5, 2])},
+      });
+    });
+
+    test('throws on out of range sparse solution', async () => {
+      const solver = sut.Solver.create();
+      await solver.setModelFromFile(loader.localUrl('simple.lp'));
+      try {
+        await solver.warmStart({
+          primalColumns: {
+            indices: new Int32Array([4]),
+            values: new Float64Array([1]),
+          },
+        });
+        fail();
+      } catch (err) {
+        expect(err).toMatchObject({code: errorCodes.NativeMethodFailed});
+        expect(err.message).toMatch(/Sparse solution index out of range/);
+      }
+    });
+
+    test('solves MIP from partial sparse solution', async () => {
+      const solver = sut.Solver.create();
+      solver.setModel({
+        isMaximization: true,
+        columnTypes: new Int32Array([
+          ColumnType.INTEGER,
+          ColumnType.INTEGER,
+          ColumnType.INTEGER,
+        ]),
+        columnLowerBounds: new Float64Array([0, 0, 0]),
+        columnUpperBounds: new Float64Array([1, 1, 1]),
+        rowLowerBounds: new Float64Array([-Infinity, -Infinity]),
+        rowUpperBounds: new Float64Array([1, 1]),
+        objectiveLinearWeights: new Float64Array([1, 1, 1]),
+        weights: {
+          offsets: new Int32Array([0, 2]),
+          indices: new Int32Array([0, 1, 1, 2]),
+          values: new Float64Array([1, 1, 1, 1]),
+        },
+      });
+      await solver.warmStart({
+        primalColumns: {
+          indices: new Int32Array([0]),
+          values: new Float64Array([1]),
+        },
+      });
+      await solver.solve();
+      expect(solver.getStatus()).toEqual(sut.SolverStatus.OPTIMAL);
+      expect(solver.getSolution()).toMatchObject({
+        objectiveValue: 2,
+        primal: {columns: new Float64Array([1, 0, 1])},
+      });
+    });
+
+    test('rejects dual values with sparse solution', async () => {
+      const solver = sut.Solver.create();
+      await solver.setModelFromFile(loader.localUrl('simple.lp'));
+      await expect(
+        solver.warmStart({
+          primalColumns: {
+            indices: new Int32Array([0]),
+            values: new Float64Array([17.5]),
+          },
+          dualRows: new Float64Array([1.5, 2.5, 11.5]),
+        })
+      ).rejects.toThrow(/Dual values require dense primal values/);
+    });
+
+    test('rejects mutations while running', async () => {
+      const solver = sut.Solver.create();
+      await solver.setModelFromFile(loader.localUrl('simple.lp'));
+      const started = solver.warmStart({
+        primalColumns: new Float64Array([17.5, 1, 15.5, 2]),
+      });
+      try {
+        solver.updateOptions({random_seed: 1});
+        fail();
+      } catch (err) {
+        expect(err).toMatchObject({code: errorCodes.WarmStartInProgress});
+      }
+      await started;
+      solver.updateOptions({random_seed: 1});
+    });
   });
 
   test('updates model', async () => {
@@ -198,6 +294,102 @@ describe('solver', () => {
     });
   });
 
+  test('solves lexicographic objectives', async () => {
+    const solver = sut.Solver.create();
+    solver.setModel({
+      isMaximization: true,
+      columnLowerBounds: new Float64Array([0, 0]),
+      columnUpperBounds: new Float64Array([10, 10]),
+      rowLowerBounds: new Float64Array([-Infinity]),
+      rowUpperBounds: new Float64Array([10]),
+      objectiveLinearWeights: new Float64Array([3, 1]),
+      weights: {
+        offsets: new Int32Array([0]),
+        indices: new Int32Array([0, 1]),
+        values: new Float64Array([1, 1]),
+      },
+    });
+    const secondary = new Float64Array([1, 0]);
+    solver.setObjectives([
+      {
+        linearWeights: new Float64Array([2, 2]),
+        isMaximization: true,
+        priority: 2,
+      },
+      {linearWeights: secondary, offset: 1, priority: 1},
+    ]);
+    secondary[1] = 5; // Objectives are copied.
+    await solver.solve();
+    expect(solver.getSolution()).toMatchObject({
+      objectiveValues: new Float64Array([20, 1]),
+      primal: {columns: new Float64Array([0, 10])},
+    });
+
+    try {
+      solver.updateObjective({offset: 1});
+      fail();
+    } catch (err) {
+      expect(err.message).toMatch(/Objectives overridden/);
+    }
+
+    solver.clearObjectives();
+    await solver.solve();
+    const sol = solver.getSolution();
+    expect(sol).toMatchObject({
+      objectiveValue: 30,
+      primal: {columns: new Float64Array([10, 0])},
+    });
+    expect(sol?.objectiveValues).toBeUndefined();
+  });
+
+  test('restores blend option', () => {
+    const solver = sut.Solver.create({
+      options: {blend_multi_objectives: false},
+    });
+    const model = {
+      isMaximization: false,
+      columnLowerBounds: new Float64Array([0]),
+      columnUpperBounds: new Float64Array([1]),
+      rowLowerBounds: new Float64Array(),
+      rowUpperBounds: new Float64Array(),
+      weights: {
+        offsets: new Int32Array(),
+        indices: new Int32Array(),
+        values: new Float64Array(),
+      },
+    };
+    solver.setModel(model);
+    solver.setModel(model);
+    expect(solver.getOption('blend_multi_objectives')).toBe(false);
+    solver.setObjectives(
+      [{linearWeights: new Float64Array([1]), priority: 1}],
+      {blend: true}
+    );
+    expect(solver.getOption('blend_multi_objectives')).toBe(true);
+    solver.clearObjectives();
+    expect(solver.getOption('blend_multi_objectives')).toBe(false);
+  });
+
+  test('rejects empty objectives', () => {
+    const solver = sut.Solver.create();
+    expect(() => solver.setObjectives([])).toThrow(/Empty objectives/);
+  });
+
+  test('clears objectives after failing to set them', async () => {
+    const solver = sut.Solver.create();
+    await solver.setModelFromFile(loader.localUrl('simple.lp'));
+    try {
+      solver.setObjectives([
+        {linearWeights: new Float64Array([1]), priority: 1},
+      ]);
+      fail();
+    } catch (err) {
+      expect(err).toMatchObject({code: errorCodes.NativeMethodFailed});
+    }
+    await solver.solve();
+    expect(solver.getSolution()?.objectiveValues).toBeUndefined();
+  });
+
   test('wraps native method errors', () => {
     const solver = sut.Solver.create();
     try {